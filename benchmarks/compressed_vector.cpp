@@ -0,0 +1,152 @@
+#include <blas_wrapper/vector.hpp>
+#include <blas_wrapper/compressed_vector.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// Compares Level 1 operations on CompressedVector<S> with Vector<double>:
+// --> error   - relative error of the result against Vector<double>
+//               (includes rounding of the inputs to storage precision)
+// --> speedup - best time of Vector<double> / best time of CompressedVector<S>
+//
+// Usage: bench_compressed_vector [n] [repeats] [threads]
+//
+// Both sides run on the same number of threads (default 1): the OpenMP
+// team is set here, the BLAS library must match it via its own setting
+// (e.g. MKL_NUM_THREADS / OPENBLAS_NUM_THREADS) for a fair speedup.
+//
+// Needs -O3 -march=native (set by benchmarks/CMakeLists.txt) and OpenMP or
+// -fopenmp-simd (set by the blas_wrapper target): otherwise the decode/encode
+// loops and fp64 reductions stay scalar and the compressed side is slower.
+
+using blas_wrapper::Vector;
+using blas_wrapper::CompressedVector;
+using blas_wrapper::bfloat16;
+using blas_wrapper::Rounding;
+
+template <typename F>
+double best_time(int repeats, F&& f) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(stop - start).count());
+    }
+    return best;
+}
+
+void report(const char* storage, const char* op, double err, double t_ref, double t) {
+    std::printf("%-14s %-6s  error %10.3e  double %9.3f ms  compressed %9.3f ms  speedup %5.2fx\n",
+        storage, op, err, t_ref * 1e3, t * 1e3, t_ref / t);
+}
+
+double rel_err(double value, double ref) {
+    return std::fabs(value - ref) / std::max(std::fabs(ref), 1e-300);
+}
+
+template <typename S>
+void bench_real(const char* storage, size_t n, int repeats) {
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    Vector<double> x(n), y(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = dist(gen);
+        y[i] = dist(gen);
+    }
+
+    CompressedVector<S> cx(x), cy(y);
+    volatile double sink = 0.0;
+    double ref = 0.0, val = 0.0, t_ref = 0.0, t = 0.0;
+
+    t_ref = best_time(repeats, [&] { sink = ref = y.dot(x); });
+    t     = best_time(repeats, [&] { sink = val = cy.dot(cx); });
+    report(storage, "dot", rel_err(val, ref), t_ref, t);
+
+    t_ref = best_time(repeats, [&] { sink = ref = y.nrm2(); });
+    t     = best_time(repeats, [&] { sink = val = cy.nrm2(); });
+    report(storage, "nrm2", rel_err(val, ref), t_ref, t);
+
+    t_ref = best_time(repeats, [&] { sink = ref = y.asum(); });
+    t     = best_time(repeats, [&] { sink = val = cy.asum(); });
+    report(storage, "asum", rel_err(val, ref), t_ref, t);
+
+    // alpha = 1e-300 keeps y unchanged between repeats, the traffic is the same
+    t_ref = best_time(repeats, [&] { y.axpy(1e-300, x); });
+    t     = best_time(repeats, [&] { cy.axpy(1e-300, cx); });
+    y.axpy(0.5, x);
+    cy.axpy(0.5, cx);
+    Vector<double> dy = cy.to_vector();
+    dy.axpy(-1.0, y);
+    report(storage, "axpy", dy.nrm2() / y.nrm2(), t_ref, t);
+
+    (void)sink;
+}
+
+void bench_complex(size_t n, int repeats) {
+    using cd = std::complex<double>;
+
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    Vector<cd> x(n), y(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = cd(dist(gen), dist(gen));
+        y[i] = cd(dist(gen), dist(gen));
+    }
+
+    CompressedVector<std::complex<float>> cx(x), cy(y);
+    volatile double sink = 0.0;
+    cd zref, zval;
+    double ref = 0.0, val = 0.0, t_ref = 0.0, t = 0.0;
+
+    t_ref = best_time(repeats, [&] { zref = y.dotc(x); sink = zref.real(); });
+    t     = best_time(repeats, [&] { zval = cy.dotc(cx); sink = zval.real(); });
+    report("complex<float>", "dotc", std::abs(zval - zref) / std::abs(zref), t_ref, t);
+
+    t_ref = best_time(repeats, [&] { sink = ref = y.nrm2(); });
+    t     = best_time(repeats, [&] { sink = val = cy.nrm2(); });
+    report("complex<float>", "nrm2", rel_err(val, ref), t_ref, t);
+
+    t_ref = best_time(repeats, [&] { sink = ref = y.asum(); });
+    t     = best_time(repeats, [&] { sink = val = cy.asum(); });
+    report("complex<float>", "asum", rel_err(val, ref), t_ref, t);
+
+    t_ref = best_time(repeats, [&] { y.axpy(cd(1e-300), x); });
+    t     = best_time(repeats, [&] { cy.axpy(cd(1e-300), cx); });
+    y.axpy(cd(0.5, 0.25), x);
+    cy.axpy(cd(0.5, 0.25), cx);
+    Vector<cd> dy = cy.to_vector();
+    dy.axpy(cd(-1.0), y);
+    report("complex<float>", "axpy", dy.nrm2() / y.nrm2(), t_ref, t);
+
+    (void)sink;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (size_t(1) << 25);
+    int repeats = argc > 2 ? std::atoi(argv[2]) : 10;
+    int threads = argc > 3 ? std::atoi(argv[3]) : 1;
+
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#else
+    threads = 1;
+#endif
+
+    std::printf("n = %zu, repeats = %d, threads = %d\n", n, repeats, threads);
+
+    bench_real<float>("float", n, repeats);
+    bench_real<bfloat16>("bfloat16", n, repeats);
+    bench_complex(n / 2, repeats);
+
+    return 0;
+}
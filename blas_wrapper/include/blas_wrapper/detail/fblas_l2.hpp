@@ -1,5 +1,52 @@
 #ifndef BLAS_WRAPPER_DETAIL_FBLAS_L2_HPP 
 #define BLAS_WRAPPER_DETAIL_FBLAS_L2_HPP 
 
+#include "fblas_l1.hpp"
 
-#endif // BLAS_WRAPPER_DETAIL_FBLAS_L2_HPP 
\ No newline at end of file
+extern "C" {
+    // --------------------- Level 2 DOUBLE ---------------------
+
+    // Level 2 - DOUBLE - gemv
+    //
+    // General matrix-vector product (A is m x n, column-major):
+    // --> y := alpha * op(A) * x + beta * y
+    // --> op(A) = A   if trans = 'N'
+    //     op(A) = A^T if trans = 'T'
+    void dgemv_(
+        const char* trans,
+        const blas_int* m,
+        const blas_int* n,
+        const double* alpha,
+        const double* a,
+        const blas_int* lda,
+        const double* x,
+        const blas_int* incx,
+        const double* beta,
+        double* y,
+        const blas_int* incy);
+
+
+    // --------------------- Level 2 COMPLEX ---------------------
+
+    // Level 2 - COMPLEX - gemv
+    //
+    // General matrix-vector product (A is m x n, column-major):
+    // --> y := alpha * op(A) * x + beta * y
+    // --> op(A) = A   if trans = 'N'
+    //     op(A) = A^T if trans = 'T'
+    //     op(A) = A^H if trans = 'C'
+    void zgemv_(
+        const char* trans,
+        const blas_int* m,
+        const blas_int* n,
+        const blas_complex_double* alpha,
+        const blas_complex_double* a,
+        const blas_int* lda,
+        const blas_complex_double* x,
+        const blas_int* incx,
+        const blas_complex_double* beta,
+        blas_complex_double* y,
+        const blas_int* incy);
+} // extern "C"
+
+#endif // BLAS_WRAPPER_DETAIL_FBLAS_L2_HPP 
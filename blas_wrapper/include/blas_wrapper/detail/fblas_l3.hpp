@@ -1,5 +1,58 @@
 #ifndef BLAS_WRAPPER_DETAIL_FBLAS_L3_HPP 
 #define BLAS_WRAPPER_DETAIL_FBLAS_L3_HPP 
 
+#include "fblas_l1.hpp"
 
-#endif // BLAS_WRAPPER_DETAIL_FBLAS_L3_HPP 
\ No newline at end of file
+extern "C" {
+    // --------------------- Level 3 DOUBLE ---------------------
+
+    // Level 3 - DOUBLE - gemm
+    //
+    // General matrix-matrix product (column-major):
+    // --> C := alpha * op(A) * op(B) + beta * C
+    // --> op(A) is m x k, op(B) is k x n, C is m x n
+    // --> op(X) = X   if trans = 'N'
+    //     op(X) = X^T if trans = 'T'
+    void dgemm_(
+        const char* transa,
+        const char* transb,
+        const blas_int* m,
+        const blas_int* n,
+        const blas_int* k,
+        const double* alpha,
+        const double* a,
+        const blas_int* lda,
+        const double* b,
+        const blas_int* ldb,
+        const double* beta,
+        double* c,
+        const blas_int* ldc);
+
+
+    // --------------------- Level 3 COMPLEX ---------------------
+
+    // Level 3 - COMPLEX - gemm
+    //
+    // General matrix-matrix product (column-major):
+    // --> C := alpha * op(A) * op(B) + beta * C
+    // --> op(A) is m x k, op(B) is k x n, C is m x n
+    // --> op(X) = X   if trans = 'N'
+    //     op(X) = X^T if trans = 'T'
+    //     op(X) = X^H if trans = 'C'
+    void zgemm_(
+        const char* transa,
+        const char* transb,
+        const blas_int* m,
+        const blas_int* n,
+        const blas_int* k,
+        const blas_complex_double* alpha,
+        const blas_complex_double* a,
+        const blas_int* lda,
+        const blas_complex_double* b,
+        const blas_int* ldb,
+        const blas_complex_double* beta,
+        blas_complex_double* c,
+        const blas_int* ldc);
+} // extern "C"
+
+#endif // BLAS_WRAPPER_DETAIL_FBLAS_L3_HPP 
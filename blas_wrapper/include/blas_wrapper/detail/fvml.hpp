@@ -0,0 +1,301 @@
+#ifndef BLAS_WRAPPER_DETAIL_FVML_HPP
+#define BLAS_WRAPPER_DETAIL_FVML_HPP
+
+#include <cstddef>
+#include <cmath>
+#include <complex>
+
+#include "fblas_l1.hpp"
+
+namespace blas_wrapper {
+
+// Accuracy mode of elementwise math functions
+// --> High                - about 1 ulp (MKL VML_HA)
+// --> Low                 - about 4 ulp (MKL VML_LA)
+// --> EnhancedPerformance - about half of mantissa bits are correct (MKL VML_EP)
+// Portable kernels ignore the mode and always use <cmath>.
+// NOTE: portable exp/log/sqrt (and abs/arg for complex) vectorize only if the
+//       compiler has a vector math library for them (SVML with icx/icpx,
+//       glibc libmvec with GCC -ffast-math); otherwise they are one scalar
+//       libm call per element. mul/div/inv always vectorize.
+enum class VmMode {
+    High,
+    Low,
+    EnhancedPerformance
+};
+
+} // namespace
+
+#ifdef BLAS_WRAPPER_USE_MKL
+
+// MKL Vector Mathematics (VM) interface.
+// Uses the vm* variants, which take the accuracy mode as the last argument.
+using vml_mode = long long;
+
+constexpr vml_mode VML_MODE_LA = 0x00000001;
+constexpr vml_mode VML_MODE_HA = 0x00000002;
+constexpr vml_mode VML_MODE_EP = 0x00000003;
+
+extern "C" {
+    // --------------------- VM DOUBLE ---------------------
+
+    // VM - DOUBLE - Mul
+    //
+    // Elementwise product:
+    // --> r[i] := a[i] * b[i]
+    void vmdMul(
+        const blas_int n,
+        const double* a,
+        const double* b,
+        double* r,
+        const vml_mode mode);
+
+    // VM - DOUBLE - Div
+    //
+    // Elementwise quotient:
+    // --> r[i] := a[i] / b[i]
+    void vmdDiv(
+        const blas_int n,
+        const double* a,
+        const double* b,
+        double* r,
+        const vml_mode mode);
+
+    // VM - DOUBLE - Exp
+    //
+    // --> r[i] := exp(a[i])
+    void vmdExp(
+        const blas_int n,
+        const double* a,
+        double* r,
+        const vml_mode mode);
+
+    // VM - DOUBLE - Ln
+    //
+    // --> r[i] := log(a[i])
+    void vmdLn(
+        const blas_int n,
+        const double* a,
+        double* r,
+        const vml_mode mode);
+
+    // VM - DOUBLE - Sqrt
+    //
+    // --> r[i] := sqrt(a[i])
+    void vmdSqrt(
+        const blas_int n,
+        const double* a,
+        double* r,
+        const vml_mode mode);
+
+    // VM - DOUBLE - Inv
+    //
+    // --> r[i] := 1 / a[i]
+    void vmdInv(
+        const blas_int n,
+        const double* a,
+        double* r,
+        const vml_mode mode);
+
+    // VM - DOUBLE - Abs
+    //
+    // --> r[i] := |a[i]|
+    void vmdAbs(
+        const blas_int n,
+        const double* a,
+        double* r,
+        const vml_mode mode);
+
+
+    // --------------------- VM COMPLEX ---------------------
+
+    // VM - COMPLEX - Mul
+    //
+    // Elementwise product:
+    // --> r[i] := a[i] * b[i]
+    void vmzMul(
+        const blas_int n,
+        const blas_complex_double* a,
+        const blas_complex_double* b,
+        blas_complex_double* r,
+        const vml_mode mode);
+
+    // VM - COMPLEX - Div
+    //
+    // Elementwise quotient:
+    // --> r[i] := a[i] / b[i]
+    void vmzDiv(
+        const blas_int n,
+        const blas_complex_double* a,
+        const blas_complex_double* b,
+        blas_complex_double* r,
+        const vml_mode mode);
+
+    // VM - COMPLEX - Exp
+    //
+    // --> r[i] := exp(a[i])
+    void vmzExp(
+        const blas_int n,
+        const blas_complex_double* a,
+        blas_complex_double* r,
+        const vml_mode mode);
+
+    // VM - COMPLEX - Ln
+    //
+    // --> r[i] := log(a[i])
+    void vmzLn(
+        const blas_int n,
+        const blas_complex_double* a,
+        blas_complex_double* r,
+        const vml_mode mode);
+
+    // VM - COMPLEX - Sqrt
+    //
+    // --> r[i] := sqrt(a[i])
+    void vmzSqrt(
+        const blas_int n,
+        const blas_complex_double* a,
+        blas_complex_double* r,
+        const vml_mode mode);
+
+    // VM - COMPLEX - Abs
+    //
+    // Modulus, result is real:
+    // --> r[i] := |a[i]|
+    void vmzAbs(
+        const blas_int n,
+        const blas_complex_double* a,
+        double* r,
+        const vml_mode mode);
+
+    // VM - COMPLEX - Arg
+    //
+    // Argument, result is real:
+    // --> r[i] := atan2(Im(a[i]), Re(a[i]))
+    void vmzArg(
+        const blas_int n,
+        const blas_complex_double* a,
+        double* r,
+        const vml_mode mode);
+} // extern "C"
+
+#endif // BLAS_WRAPPER_USE_MKL
+
+namespace blas_wrapper {
+namespace detail {
+
+#ifdef BLAS_WRAPPER_USE_MKL
+inline vml_mode to_vml_mode(VmMode mode) {
+    switch (mode) {
+        case VmMode::Low:                 return VML_MODE_LA;
+        case VmMode::EnhancedPerformance: return VML_MODE_EP;
+        case VmMode::High:
+        default:                          return VML_MODE_HA;
+    }
+}
+#endif
+
+// Portable elementwise kernels, used when MKL is not available
+// (and for operations MKL VM does not provide).
+// All of them allow r to alias any input.
+
+template <typename T>
+inline void vm_mul(size_t n, const T* a, const T* b, T* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = a[i] * b[i];
+}
+
+template <typename T>
+inline void vm_div(size_t n, const T* a, const T* b, T* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = a[i] / b[i];
+}
+
+template <typename T>
+inline void vm_inv(size_t n, const T* a, T* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = T(1) / a[i];
+}
+
+// Complex mul/div/inv are spelled out: std::complex operator* and operator/
+// add NaN/Inf recovery (__muldc3/__divdc3 calls) that keeps the loops from
+// vectorizing. Division scales b by 1 / (|Re b| + |Im b|) first, so |b|^2
+// neither overflows nor underflows. No C99 Annex G recovery of NaN/Inf results.
+
+inline void vm_mul(size_t n, const std::complex<double>* a, const std::complex<double>* b, std::complex<double>* r) {
+    const double* pa = reinterpret_cast<const double*>(a);
+    const double* pb = reinterpret_cast<const double*>(b);
+    double* pr = reinterpret_cast<double*>(r);
+
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) {
+        double ar = pa[2 * i], ai = pa[2 * i + 1];
+        double br = pb[2 * i], bi = pb[2 * i + 1];
+        pr[2 * i]     = ar * br - ai * bi;
+        pr[2 * i + 1] = ar * bi + ai * br;
+    }
+}
+
+inline void vm_div(size_t n, const std::complex<double>* a, const std::complex<double>* b, std::complex<double>* r) {
+    const double* pa = reinterpret_cast<const double*>(a);
+    const double* pb = reinterpret_cast<const double*>(b);
+    double* pr = reinterpret_cast<double*>(r);
+
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) {
+        double ar = pa[2 * i], ai = pa[2 * i + 1];
+        double s = 1.0 / (std::fabs(pb[2 * i]) + std::fabs(pb[2 * i + 1]));
+        double cr = pb[2 * i] * s, ci = pb[2 * i + 1] * s;
+        double q = s / (cr * cr + ci * ci);
+        pr[2 * i]     = (ar * cr + ai * ci) * q;
+        pr[2 * i + 1] = (ai * cr - ar * ci) * q;
+    }
+}
+
+inline void vm_inv(size_t n, const std::complex<double>* a, std::complex<double>* r) {
+    const double* pa = reinterpret_cast<const double*>(a);
+    double* pr = reinterpret_cast<double*>(r);
+
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) {
+        double s = 1.0 / (std::fabs(pa[2 * i]) + std::fabs(pa[2 * i + 1]));
+        double cr = pa[2 * i] * s, ci = pa[2 * i + 1] * s;
+        double q = s / (cr * cr + ci * ci);
+        pr[2 * i]     = cr * q;
+        pr[2 * i + 1] = -ci * q;
+    }
+}
+
+template <typename T>
+inline void vm_exp(size_t n, const T* a, T* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = std::exp(a[i]);
+}
+
+template <typename T>
+inline void vm_log(size_t n, const T* a, T* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = std::log(a[i]);
+}
+
+template <typename T>
+inline void vm_sqrt(size_t n, const T* a, T* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = std::sqrt(a[i]);
+}
+
+template <typename T>
+inline void vm_abs(size_t n, const T* a, double* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = std::abs(a[i]);
+}
+
+inline void vm_arg(size_t n, const std::complex<double>* a, double* r) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++) r[i] = std::arg(a[i]);
+}
+
+} // namespace detail
+} // namespace blas_wrapper
+
+#endif // BLAS_WRAPPER_DETAIL_FVML_HPP
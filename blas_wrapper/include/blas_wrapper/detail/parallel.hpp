@@ -0,0 +1,48 @@
+#ifndef BLAS_WRAPPER_DETAIL_PARALLEL_HPP
+#define BLAS_WRAPPER_DETAIL_PARALLEL_HPP
+
+#include <cstddef>
+#include <algorithm>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace blas_wrapper {
+namespace detail {
+
+// Minimal vector length for which the work is split across threads.
+// Below it the overhead of an OpenMP region outweighs the gain.
+constexpr size_t parallel_threshold = size_t(1) << 15;
+
+// Split [0, n) into one contiguous chunk per thread and call
+// --> kernel(offset, count)
+// Chunks are static, so the same thread always touches the same range.
+// Without OpenMP (or for small n) kernel is called once for the whole range.
+template <typename Kernel>
+inline void parallel_chunks(size_t n, Kernel&& kernel) {
+    if (n == 0) return;
+
+#ifdef _OPENMP
+    if (n >= parallel_threshold && omp_get_max_threads() > 1 && !omp_in_parallel()) {
+        #pragma omp parallel
+        {
+            size_t nth = static_cast<size_t>(omp_get_num_threads());
+            size_t tid = static_cast<size_t>(omp_get_thread_num());
+            size_t chunk = (n + nth - 1) / nth;
+            size_t begin = tid * chunk;
+            size_t end = std::min(n, begin + chunk);
+
+            if (begin < end) kernel(begin, end - begin);
+        }
+        return;
+    }
+#endif
+
+    kernel(size_t(0), n);
+}
+
+} // namespace detail
+} // namespace blas_wrapper
+
+#endif // BLAS_WRAPPER_DETAIL_PARALLEL_HPP
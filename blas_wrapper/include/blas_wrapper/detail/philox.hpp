@@ -0,0 +1,79 @@
+#ifndef BLAS_WRAPPER_DETAIL_PHILOX_HPP
+#define BLAS_WRAPPER_DETAIL_PHILOX_HPP
+
+#include <cstdint>
+#include <cmath>
+
+namespace blas_wrapper {
+namespace detail {
+
+// Philox4x32-10 counter-based generator (Salmon et al., SC'11).
+// Output is a pure function of (counter, key), so any element of a random
+// sequence can be computed independently: the result does not depend on
+// how the work is split across threads.
+
+struct philox_block {
+    std::uint32_t v[4];
+};
+
+inline philox_block philox4x32(std::uint64_t block, std::uint64_t stream, std::uint64_t seed) {
+    constexpr std::uint32_t M0 = 0xD2511F53u;
+    constexpr std::uint32_t M1 = 0xCD9E8D57u;
+    constexpr std::uint32_t W0 = 0x9E3779B9u;
+    constexpr std::uint32_t W1 = 0xBB67AE85u;
+
+    std::uint32_t c0 = static_cast<std::uint32_t>(block);
+    std::uint32_t c1 = static_cast<std::uint32_t>(block >> 32);
+    std::uint32_t c2 = static_cast<std::uint32_t>(stream);
+    std::uint32_t c3 = static_cast<std::uint32_t>(stream >> 32);
+    std::uint32_t k0 = static_cast<std::uint32_t>(seed);
+    std::uint32_t k1 = static_cast<std::uint32_t>(seed >> 32);
+
+    for (int round = 0; round < 10; round++) {
+        std::uint64_t p0 = static_cast<std::uint64_t>(M0) * c0;
+        std::uint64_t p1 = static_cast<std::uint64_t>(M1) * c2;
+
+        std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32);
+        std::uint32_t lo0 = static_cast<std::uint32_t>(p0);
+        std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32);
+        std::uint32_t lo1 = static_cast<std::uint32_t>(p1);
+
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+
+        k0 += W0;
+        k1 += W1;
+    }
+
+    return philox_block{ { c0, c1, c2, c3 } };
+}
+
+// 53 random bits -> double in [0, 1)
+inline double uniform_co(std::uint32_t lo, std::uint32_t hi) {
+    std::uint64_t u = (static_cast<std::uint64_t>(hi) << 32) | lo;
+    return static_cast<double>(u >> 11) * 0x1.0p-53;
+}
+
+// 53 random bits -> double in (0, 1], safe for log()
+inline double uniform_oc(std::uint32_t lo, std::uint32_t hi) {
+    std::uint64_t u = (static_cast<std::uint64_t>(hi) << 32) | lo;
+    return static_cast<double>((u >> 11) + 1) * 0x1.0p-53;
+}
+
+// Box-Muller: one Philox block -> two independent N(0, 1) samples
+inline void normal_pair(const philox_block& r, double& z0, double& z1) {
+    constexpr double two_pi = 6.283185307179586476925286766559;
+
+    double radius = std::sqrt(-2.0 * std::log(uniform_oc(r.v[0], r.v[1])));
+    double theta = two_pi * uniform_co(r.v[2], r.v[3]);
+
+    z0 = radius * std::cos(theta);
+    z1 = radius * std::sin(theta);
+}
+
+} // namespace detail
+} // namespace blas_wrapper
+
+#endif // BLAS_WRAPPER_DETAIL_PHILOX_HPP
@@ -0,0 +1,116 @@
+#ifndef BLAS_WRAPPER_DETAIL_REDUCED_PRECISION_HPP
+#define BLAS_WRAPPER_DETAIL_REDUCED_PRECISION_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <complex>
+
+namespace blas_wrapper {
+
+// Brain floating point: upper 16 bits of an IEEE fp32
+// (8 exponent bits, 7 mantissa bits).
+struct bfloat16 {
+    std::uint16_t bits;
+};
+
+// Rounding used when a double result is written back to reduced storage
+// --> NearestEven - round to nearest, ties to even (IEEE default)
+// --> TowardZero  - truncate the magnitude
+enum class Rounding {
+    NearestEven,
+    TowardZero
+};
+
+namespace detail {
+
+inline std::uint32_t float_bits(float f) {
+    std::uint32_t b;
+    std::memcpy(&b, &f, sizeof(b));
+    return b;
+}
+
+inline float bits_float(std::uint32_t b) {
+    float f;
+    std::memcpy(&f, &b, sizeof(f));
+    return f;
+}
+
+// double -> float, rounded toward zero.
+// A cast that rounded away from zero is moved back by one ulp
+// (for finite results that is one step down in the magnitude bits,
+// for overflow to inf it gives FLT_MAX).
+inline std::uint32_t float_bits_toward_zero(double d) {
+    float f = static_cast<float>(d);
+    std::uint32_t b = float_bits(f);
+    b -= static_cast<std::uint32_t>(std::fabs(static_cast<double>(f)) > std::fabs(d));
+    return b;
+}
+
+inline float encode_float(double d, Rounding mode) {
+    if (mode == Rounding::TowardZero) return bits_float(float_bits_toward_zero(d));
+    return static_cast<float>(d);
+}
+
+inline double decode_float(float f) {
+    return static_cast<double>(f);
+}
+
+// double -> bfloat16.
+// NearestEven goes through an fp32 rounded to odd, so the two-step
+// conversion does not round twice.
+inline bfloat16 encode_bf16(double d, Rounding mode) {
+    std::uint32_t t = float_bits_toward_zero(d);
+    std::uint32_t b = t;
+
+    if (mode == Rounding::NearestEven) {
+        b |= static_cast<std::uint32_t>(static_cast<double>(bits_float(b)) != d);
+        b += 0x7FFFu + ((b >> 16) & 1u);
+    }
+
+    // NaN must stay NaN (and quiet) after dropping the low mantissa bits
+    if (std::isnan(d)) b = t | 0x00400000u;
+
+    return bfloat16{ static_cast<std::uint16_t>(b >> 16) };
+}
+
+inline double decode_bf16(bfloat16 h) {
+    return static_cast<double>(bits_float(static_cast<std::uint32_t>(h.bits) << 16));
+}
+
+// Storage type S -> compute type (value_type) and its codec
+template <typename S>
+struct storage_traits;
+
+template <>
+struct storage_traits<float> {
+    using value_type = double;
+
+    static value_type decode(float s) { return decode_float(s); }
+    static float encode(value_type v, Rounding mode) { return encode_float(v, mode); }
+};
+
+template <>
+struct storage_traits<bfloat16> {
+    using value_type = double;
+
+    static value_type decode(bfloat16 s) { return decode_bf16(s); }
+    static bfloat16 encode(value_type v, Rounding mode) { return encode_bf16(v, mode); }
+};
+
+template <>
+struct storage_traits<std::complex<float>> {
+    using value_type = std::complex<double>;
+
+    static value_type decode(std::complex<float> s) {
+        return value_type(decode_float(s.real()), decode_float(s.imag()));
+    }
+    static std::complex<float> encode(value_type v, Rounding mode) {
+        return std::complex<float>(encode_float(v.real(), mode), encode_float(v.imag(), mode));
+    }
+};
+
+} // namespace detail
+} // namespace blas_wrapper
+
+#endif // BLAS_WRAPPER_DETAIL_REDUCED_PRECISION_HPP
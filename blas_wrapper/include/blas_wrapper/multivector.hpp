@@ -0,0 +1,275 @@
+#ifndef BLAS_WRAPPER_MULTIVECTOR_HPP
+#define BLAS_WRAPPER_MULTIVECTOR_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include <complex>
+#include <cassert>
+
+#include "vector.hpp"
+#include "detail/fblas_l1.hpp"
+#include "detail/fblas_l2.hpp"
+#include "detail/fblas_l3.hpp"
+
+namespace blas_wrapper {
+
+// Block of k vectors of equal length n, stored contiguously column-major
+// (column j starts at data() + j * n). Block operations read every column
+// once through a single Level 2/3 call instead of k Level 1 calls.
+template <typename T>
+class MultiVector {
+    static_assert(
+        std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>,
+        "MultiVector<T> only supports T = double or std::complex<double>"
+    );
+private:
+    T* data_;
+    size_t rows_;
+    size_t cols_;
+public:
+    MultiVector() : data_(nullptr), rows_(0), cols_(0) { }
+
+    MultiVector(size_t rows, size_t cols) : rows_(rows), cols_(cols) {
+        if (rows * cols == 0) data_ = nullptr;
+        else data_ = new T[rows_ * cols_];
+    }
+
+    MultiVector(const MultiVector& other) : data_(nullptr), rows_(other.rows_), cols_(other.cols_) {
+        if (rows_ * cols_ > 0) data_ = new T[rows_ * cols_];
+
+        for (size_t i = 0; i < rows_ * cols_; i++) {
+            this->data_[i] = other.data_[i];
+        }
+    }
+
+    ~MultiVector() {
+        delete[] data_;
+    }
+
+    MultiVector& operator=(const MultiVector& other) {
+        if (this != &other) {
+            MultiVector(other).swap_cv(*this);
+        }
+
+        return *this;
+    }
+
+    T& operator()(size_t row, size_t col) const {
+        assert(row < rows_ && col < cols_ && "Index out of range access");
+        return data_[col * rows_ + row];
+    }
+
+    void swap_cv(MultiVector& other) {
+        std::swap(rows_, other.rows_);
+        std::swap(cols_, other.cols_);
+        std::swap(data_, other.data_);
+    }
+
+    T* data() const {
+        return data_;
+    }
+
+    // Length n of every vector
+    size_t rows() const {
+        return rows_;
+    }
+
+    // Number k of vectors
+    size_t cols() const {
+        return cols_;
+    }
+
+    // Column j as a non-owning Vector view
+    Vector<T> col(size_t j) const {
+        assert(j < cols_ && "Column index out of range");
+        return Vector<T>(data_ + j * rows_, rows_);
+    }
+
+    // ---------- ОБЕРТКИ ----------
+
+    // Block dot product (one gemv instead of k dot calls):
+    // --> r := V^T * x    (double)
+    // --> r := V^H * x    (complex, r_j = v_j^H x = x.dotc(col(j)))
+    void dots(const Vector<T>& x, Vector<T>& r) const {
+        assert(rows_ == x.size() && "Vector size must match MultiVector rows");
+        assert(cols_ == r.size() && "Result size must match MultiVector cols");
+
+        // gemv returns early for m = 0 without touching r, but empty dots are 0
+        if (rows_ == 0) {
+            std::fill(r.data(), r.data() + cols_, T(0));
+            return;
+        }
+
+        blas_int m = static_cast<blas_int>(rows_);
+        blas_int n = static_cast<blas_int>(cols_);
+        blas_int lda = static_cast<blas_int>(std::max<size_t>(rows_, 1));
+        blas_int inc = 1;
+        T alpha = T(1);
+        T beta = T(0);
+
+        if constexpr (std::is_same_v<T, double>) {
+            dgemv_(
+                "T",
+                &m,
+                &n,
+                &alpha,
+                this->data(),
+                &lda,
+                x.data(),
+                &inc,
+                &beta,
+                r.data(),
+                &inc);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>) {
+            zgemv_(
+                "C",
+                &m,
+                &n,
+                static_cast<blas_complex_double*>(&alpha),
+                static_cast<blas_complex_double*>(this->data()),
+                &lda,
+                static_cast<blas_complex_double*>(x.data()),
+                &inc,
+                static_cast<blas_complex_double*>(&beta),
+                static_cast<blas_complex_double*>(r.data()),
+                &inc);
+        }
+    }
+
+    Vector<T> dots(const Vector<T>& x) const {
+        Vector<T> r(cols_);
+        dots(x, r);
+        return r;
+    }
+
+    // Block update (one gemv instead of k axpy calls):
+    // --> y := alpha * V * coeffs + y
+    // e.g. Gram-Schmidt step is update(h, w, -1) with h = dots(w)
+    void update(const Vector<T>& coeffs, Vector<T>& y, T alpha = T(1)) const {
+        assert(cols_ == coeffs.size() && "Coefficients size must match MultiVector cols");
+        assert(rows_ == y.size() && "Vector size must match MultiVector rows");
+
+        blas_int m = static_cast<blas_int>(rows_);
+        blas_int n = static_cast<blas_int>(cols_);
+        blas_int lda = static_cast<blas_int>(std::max<size_t>(rows_, 1));
+        blas_int inc = 1;
+        T beta = T(1);
+
+        if constexpr (std::is_same_v<T, double>) {
+            dgemv_(
+                "N",
+                &m,
+                &n,
+                &alpha,
+                this->data(),
+                &lda,
+                coeffs.data(),
+                &inc,
+                &beta,
+                y.data(),
+                &inc);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>) {
+            zgemv_(
+                "N",
+                &m,
+                &n,
+                static_cast<blas_complex_double*>(&alpha),
+                static_cast<blas_complex_double*>(this->data()),
+                &lda,
+                static_cast<blas_complex_double*>(coeffs.data()),
+                &inc,
+                static_cast<blas_complex_double*>(&beta),
+                static_cast<blas_complex_double*>(y.data()),
+                &inc);
+        }
+    }
+
+    // Gram matrix (one gemm instead of k^2 dot calls):
+    // --> G := V^T * V    (double)
+    // --> G := V^H * V    (complex)
+    // G is returned as a k x k MultiVector
+    MultiVector<T> gram() const {
+        MultiVector<T> g(cols_, cols_);
+        if (cols_ == 0) return g;
+
+        blas_int k = static_cast<blas_int>(cols_);
+        blas_int n = static_cast<blas_int>(rows_);
+        blas_int lda = static_cast<blas_int>(std::max<size_t>(rows_, 1));
+        T alpha = T(1);
+        T beta = T(0);
+
+        if constexpr (std::is_same_v<T, double>) {
+            dgemm_(
+                "T",
+                "N",
+                &k,
+                &k,
+                &n,
+                &alpha,
+                this->data(),
+                &lda,
+                this->data(),
+                &lda,
+                &beta,
+                g.data(),
+                &k);
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>) {
+            zgemm_(
+                "C",
+                "N",
+                &k,
+                &k,
+                &n,
+                static_cast<blas_complex_double*>(&alpha),
+                static_cast<blas_complex_double*>(this->data()),
+                &lda,
+                static_cast<blas_complex_double*>(this->data()),
+                &lda,
+                static_cast<blas_complex_double*>(&beta),
+                static_cast<blas_complex_double*>(g.data()),
+                &k);
+        }
+
+        return g;
+    }
+
+    // Block 2-norm, every column is read once:
+    // --> r_j := ||v_j||_2
+    void nrm2(Vector<double>& r) const {
+        assert(cols_ == r.size() && "Result size must match MultiVector cols");
+
+        blas_int n = static_cast<blas_int>(rows_);
+        blas_int inc = 1;
+        long long k = static_cast<long long>(cols_);
+
+        #pragma omp parallel for if(rows_ * cols_ >= detail::parallel_threshold && cols_ > 1)
+        for (long long j = 0; j < k; j++) {
+            if constexpr (std::is_same_v<T, double>) {
+                r.data()[j] = dnrm2_(
+                    &n,
+                    this->data() + j * rows_,
+                    &inc);
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                r.data()[j] = dznrm2_(
+                    &n,
+                    static_cast<blas_complex_double*>(this->data() + j * rows_),
+                    &inc);
+            }
+        }
+    }
+
+    Vector<double> nrm2() const {
+        Vector<double> r(cols_);
+        nrm2(r);
+        return r;
+    }
+}; // class
+
+} // namespace
+
+#endif // BLAS_WRAPPER_MULTIVECTOR_HPP
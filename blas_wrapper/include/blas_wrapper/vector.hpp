@@ -6,8 +6,13 @@
 #include <type_traits>
 #include <complex>
 #include <cassert>
+#include <cstdint>
+#include <new>
 
 #include "detail/fblas_l1.hpp"
+#include "detail/fvml.hpp"
+#include "detail/parallel.hpp"
+#include "detail/philox.hpp"
 
 namespace blas_wrapper {
 
@@ -20,29 +25,50 @@ class Vector {
 private:
     T* data_;
     size_t size_;
+    bool owns_data_;
+
+    // Uninitialized storage (new T[n] would zero std::complex elements),
+    // so the first write, e.g. a parallel fill, is the NUMA first touch.
+    // Both supported T are trivially destructible.
+    static T* allocate(size_t n) {
+        if (n == 0) return nullptr;
+        return static_cast<T*>(::operator new[](n * sizeof(T)));
+    }
 public:
-    Vector() : data_(nullptr), size_(0) { }
+    Vector() : data_(nullptr), size_(0), owns_data_(true) { }
     
-    Vector(size_t n) : size_(n) {
-        if (n == 0) data_ = nullptr;
-        else data_ = new T[size_];
-    }
+    // Elements are left uninitialized
+    Vector(size_t n) : data_(allocate(n)), size_(n), owns_data_(true) { }
+
+    // Non-owning view of n elements at data (e.g. a MultiVector column).
+    // Writes (including operator=) go to the viewed memory, which must
+    // outlive the view. Copies of a view (by-value arguments, containers)
+    // are views of the same memory; use clone() for an owning copy.
+    Vector(T* data, size_t n) : data_(data), size_(n), owns_data_(false) { }
     
-    Vector(const Vector& other) : data_(nullptr), size_(other.size_) {
-        if (size_ > 0) data_ = new T[size_];
-        
+    Vector(const Vector& other) : data_(other.data_), size_(other.size_), owns_data_(other.owns_data_) {
+        if (!owns_data_) return;
+
+        data_ = allocate(size_);
         for (size_t i = 0; i < size_; i++) {
             this->data_[i] = other.data_[i];
         }
     }
     
     ~Vector() {
-        delete[] data_;
+        if (owns_data_) ::operator delete[](data_);
     }
 
+    // Assigning to a view writes the elements through and keeps it a view
     Vector& operator=(const Vector& other) {
         if (this != &other) {
-            Vector(other).swap_cv(*this);
+            if (!owns_data_) {
+                assert(size_ == other.size_ && "Vector sizes must match");
+                copy(other);
+            }
+            else {
+                other.clone().swap_cv(*this);
+            }
         }
 
         return *this;
@@ -56,6 +82,7 @@ public:
     void swap_cv(Vector& other) {
         std::swap(size_, other.size_);
         std::swap(data_, other.data_);
+        std::swap(owns_data_, other.owns_data_);
     }
 
     T* data() const {
@@ -66,6 +93,20 @@ public:
         return size_;
     }
 
+    bool is_view() const {
+        return !owns_data_;
+    }
+
+    // Owning deep copy, also of a view
+    Vector clone() const {
+        Vector result(size_);
+        for (size_t i = 0; i < size_; i++) {
+            result.data_[i] = data_[i];
+        }
+
+        return result;
+    }
+
     // ---------- ОБЕРТКИ ----------
     
     // Update vector y with x:
@@ -369,6 +410,395 @@ public:
             &inc,
             param);
     }
+
+    // ---------- ПОЭЛЕМЕНТНЫЕ ОПЕРАЦИИ ----------
+    //
+    // Dispatch to MKL VM when BLAS_WRAPPER_USE_MKL is defined, otherwise to
+    // portable omp-simd kernels (see detail/fvml.hpp: mul/div/inv always
+    // vectorize, transcendentals only with a vector math library).
+    // Long vectors are split across OpenMP threads.
+    // Every operation has an in-place form (y := f(y)) and an
+    // out-of-place form (y := f(x)); x may be y itself.
+
+    // Elementwise product (Hadamard):
+    // --> y := y .* x
+    void mul(const Vector<T>& x, VmMode mode = VmMode::High) {
+        mul(*this, x, mode);
+    }
+
+    // Elementwise product (Hadamard):
+    // --> y := a .* b
+    void mul(const Vector<T>& a, const Vector<T>& b, VmMode mode = VmMode::High) {
+        assert(size_ == a.size() && size_ == b.size() && "Vector sizes must match");
+
+        const T* pa = a.data();
+        const T* pb = b.data();
+        T* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            blas_int n = static_cast<blas_int>(cnt);
+
+            if constexpr (std::is_same_v<T, double>) {
+                vmdMul(n, pa + off, pb + off, pr + off, detail::to_vml_mode(mode));
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                vmzMul(n, pa + off, pb + off, pr + off, detail::to_vml_mode(mode));
+            }
+#else
+            (void)mode;
+            detail::vm_mul(cnt, pa + off, pb + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise quotient:
+    // --> y := y ./ x
+    void div(const Vector<T>& x, VmMode mode = VmMode::High) {
+        div(*this, x, mode);
+    }
+
+    // Elementwise quotient:
+    // --> y := a ./ b
+    void div(const Vector<T>& a, const Vector<T>& b, VmMode mode = VmMode::High) {
+        assert(size_ == a.size() && size_ == b.size() && "Vector sizes must match");
+
+        const T* pa = a.data();
+        const T* pb = b.data();
+        T* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            blas_int n = static_cast<blas_int>(cnt);
+
+            if constexpr (std::is_same_v<T, double>) {
+                vmdDiv(n, pa + off, pb + off, pr + off, detail::to_vml_mode(mode));
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                vmzDiv(n, pa + off, pb + off, pr + off, detail::to_vml_mode(mode));
+            }
+#else
+            (void)mode;
+            detail::vm_div(cnt, pa + off, pb + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise reciprocal:
+    // --> y := 1 ./ y
+    void inv(VmMode mode = VmMode::High) {
+        inv(*this, mode);
+    }
+
+    // Elementwise reciprocal:
+    // --> y := 1 ./ x
+    // NOTE: MKL VM has no complex Inv, complex vectors always use the portable kernel
+    void inv(const Vector<T>& x, VmMode mode = VmMode::High) {
+        assert(size_ == x.size() && "Vector sizes must match");
+
+        const T* px = x.data();
+        T* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            if constexpr (std::is_same_v<T, double>) {
+                vmdInv(static_cast<blas_int>(cnt), px + off, pr + off, detail::to_vml_mode(mode));
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                detail::vm_inv(cnt, px + off, pr + off);
+            }
+#else
+            (void)mode;
+            detail::vm_inv(cnt, px + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise exponent:
+    // --> y := exp(y)
+    void exp(VmMode mode = VmMode::High) {
+        exp(*this, mode);
+    }
+
+    // Elementwise exponent:
+    // --> y := exp(x)
+    void exp(const Vector<T>& x, VmMode mode = VmMode::High) {
+        assert(size_ == x.size() && "Vector sizes must match");
+
+        const T* px = x.data();
+        T* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            blas_int n = static_cast<blas_int>(cnt);
+
+            if constexpr (std::is_same_v<T, double>) {
+                vmdExp(n, px + off, pr + off, detail::to_vml_mode(mode));
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                vmzExp(n, px + off, pr + off, detail::to_vml_mode(mode));
+            }
+#else
+            (void)mode;
+            detail::vm_exp(cnt, px + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise natural logarithm:
+    // --> y := log(y)
+    void log(VmMode mode = VmMode::High) {
+        log(*this, mode);
+    }
+
+    // Elementwise natural logarithm:
+    // --> y := log(x)
+    void log(const Vector<T>& x, VmMode mode = VmMode::High) {
+        assert(size_ == x.size() && "Vector sizes must match");
+
+        const T* px = x.data();
+        T* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            blas_int n = static_cast<blas_int>(cnt);
+
+            if constexpr (std::is_same_v<T, double>) {
+                vmdLn(n, px + off, pr + off, detail::to_vml_mode(mode));
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                vmzLn(n, px + off, pr + off, detail::to_vml_mode(mode));
+            }
+#else
+            (void)mode;
+            detail::vm_log(cnt, px + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise square root:
+    // --> y := sqrt(y)
+    void sqrt(VmMode mode = VmMode::High) {
+        sqrt(*this, mode);
+    }
+
+    // Elementwise square root:
+    // --> y := sqrt(x)
+    void sqrt(const Vector<T>& x, VmMode mode = VmMode::High) {
+        assert(size_ == x.size() && "Vector sizes must match");
+
+        const T* px = x.data();
+        T* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            blas_int n = static_cast<blas_int>(cnt);
+
+            if constexpr (std::is_same_v<T, double>) {
+                vmdSqrt(n, px + off, pr + off, detail::to_vml_mode(mode));
+            }
+            else if constexpr (std::is_same_v<T, std::complex<double>>) {
+                vmzSqrt(n, px + off, pr + off, detail::to_vml_mode(mode));
+            }
+#else
+            (void)mode;
+            detail::vm_sqrt(cnt, px + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise absolute value:
+    // --> y := |y|
+    void abs(VmMode mode = VmMode::High) {
+        static_assert(std::is_same_v<T, double>, "Vector::abs in-place is only supported for double");
+        abs(*this, mode);
+    }
+
+    // Elementwise absolute value:
+    // --> y := |x|
+    void abs(const Vector<double>& x, VmMode mode = VmMode::High) {
+        static_assert(std::is_same_v<T, double>, "Vector::abs result must be Vector<double>");
+        assert(size_ == x.size() && "Vector sizes must match");
+
+        const double* px = x.data();
+        double* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            vmdAbs(static_cast<blas_int>(cnt), px + off, pr + off, detail::to_vml_mode(mode));
+#else
+            (void)mode;
+            detail::vm_abs(cnt, px + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise modulus of complex vector:
+    // --> y := |z|
+    void abs(const Vector<std::complex<double>>& z, VmMode mode = VmMode::High) {
+        static_assert(std::is_same_v<T, double>, "Vector::abs result must be Vector<double>");
+        assert(size_ == z.size() && "Vector sizes must match");
+
+        const std::complex<double>* pz = z.data();
+        double* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            vmzAbs(static_cast<blas_int>(cnt), pz + off, pr + off, detail::to_vml_mode(mode));
+#else
+            (void)mode;
+            detail::vm_abs(cnt, pz + off, pr + off);
+#endif
+        });
+    }
+
+    // Elementwise argument of complex vector:
+    // --> y := arg(z) = atan2(Im(z), Re(z))
+    void arg(const Vector<std::complex<double>>& z, VmMode mode = VmMode::High) {
+        static_assert(std::is_same_v<T, double>, "Vector::arg result must be Vector<double>");
+        assert(size_ == z.size() && "Vector sizes must match");
+
+        const std::complex<double>* pz = z.data();
+        double* pr = this->data();
+
+        detail::parallel_chunks(size_, [&](size_t off, size_t cnt) {
+#ifdef BLAS_WRAPPER_USE_MKL
+            vmzArg(static_cast<blas_int>(cnt), pz + off, pr + off, detail::to_vml_mode(mode));
+#else
+            (void)mode;
+            detail::vm_arg(cnt, pz + off, pr + off);
+#endif
+        });
+    }
+
+    // ---------- СЛУЧАЙНОЕ ЗАПОЛНЕНИЕ ----------
+    //
+    // Bulk fills on the Philox4x32-10 counter-based generator. Element i
+    // depends only on (seed, stream, i), so a given seed gives the same
+    // vector for any number of threads. Different streams give independent
+    // sequences for the same seed. Threads fill static contiguous chunks,
+    // so calling a fill right after Vector<T>(n), which leaves memory
+    // untouched, also places pages NUMA first-touch next to the thread
+    // that owns the chunk.
+    //
+    // Each chunk is a branch-free SIMD loop over whole Philox blocks plus
+    // at most one partial block at the end of the vector.
+
+    // Uniform distribution on [a, b):
+    // --> double  - y_i ~ U[a, b)
+    // --> complex - Re(y_i), Im(y_i) ~ U[a, b) independently
+    void fill_uniform(std::uint64_t seed, double a = 0.0, double b = 1.0, std::uint64_t stream = 0) {
+        T* py = this->data();
+        size_t n = size_;
+        double scale = b - a;
+
+        if constexpr (std::is_same_v<T, double>) {
+            // One Philox block -> 2 elements
+            detail::parallel_chunks((n + 1) / 2, [&](size_t off, size_t cnt) {
+                size_t full = std::min(off + cnt, n / 2);
+
+                #pragma omp simd
+                for (size_t blk = off; blk < full; blk++) {
+                    detail::philox_block r = detail::philox4x32(blk, stream, seed);
+                    py[2 * blk] = a + scale * detail::uniform_co(r.v[0], r.v[1]);
+                    py[2 * blk + 1] = a + scale * detail::uniform_co(r.v[2], r.v[3]);
+                }
+
+                if (full < off + cnt) {
+                    detail::philox_block r = detail::philox4x32(full, stream, seed);
+                    py[2 * full] = a + scale * detail::uniform_co(r.v[0], r.v[1]);
+                }
+            });
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>) {
+            // One Philox block -> 1 element
+            double* pd = reinterpret_cast<double*>(py);
+
+            detail::parallel_chunks(n, [&](size_t off, size_t cnt) {
+                #pragma omp simd
+                for (size_t blk = off; blk < off + cnt; blk++) {
+                    detail::philox_block r = detail::philox4x32(blk, stream, seed);
+                    pd[2 * blk] = a + scale * detail::uniform_co(r.v[0], r.v[1]);
+                    pd[2 * blk + 1] = a + scale * detail::uniform_co(r.v[2], r.v[3]);
+                }
+            });
+        }
+    }
+
+    // Normal distribution (Box-Muller):
+    // --> double  - y_i ~ N(mean, stddev^2)
+    // --> complex - y_i ~ CN(mean, stddev^2), i.e. Re and Im are independent
+    //               N(Re(mean), stddev^2 / 2) and N(Im(mean), stddev^2 / 2)
+    void fill_normal(std::uint64_t seed, T mean = T(0), double stddev = 1.0, std::uint64_t stream = 0) {
+        T* py = this->data();
+        size_t n = size_;
+
+        if constexpr (std::is_same_v<T, double>) {
+            // One Philox block -> 2 elements
+            detail::parallel_chunks((n + 1) / 2, [&](size_t off, size_t cnt) {
+                size_t full = std::min(off + cnt, n / 2);
+
+                #pragma omp simd
+                for (size_t blk = off; blk < full; blk++) {
+                    double z0, z1;
+                    detail::normal_pair(detail::philox4x32(blk, stream, seed), z0, z1);
+                    py[2 * blk] = mean + stddev * z0;
+                    py[2 * blk + 1] = mean + stddev * z1;
+                }
+
+                if (full < off + cnt) {
+                    double z0, z1;
+                    detail::normal_pair(detail::philox4x32(full, stream, seed), z0, z1);
+                    py[2 * full] = mean + stddev * z0;
+                }
+            });
+        }
+        else if constexpr (std::is_same_v<T, std::complex<double>>) {
+            // One Philox block -> 1 element
+            double* pd = reinterpret_cast<double*>(py);
+            double re = mean.real();
+            double im = mean.imag();
+            double scale = stddev * 0.70710678118654752440;
+
+            detail::parallel_chunks(n, [&](size_t off, size_t cnt) {
+                #pragma omp simd
+                for (size_t blk = off; blk < off + cnt; blk++) {
+                    double z0, z1;
+                    detail::normal_pair(detail::philox4x32(blk, stream, seed), z0, z1);
+                    pd[2 * blk] = re + scale * z0;
+                    pd[2 * blk + 1] = im + scale * z1;
+                }
+            });
+        }
+    }
+
+    // Rademacher distribution:
+    // --> y_i = +1 or -1 with probability 1/2
+    void fill_rademacher(std::uint64_t seed, std::uint64_t stream = 0) {
+        static_assert(std::is_same_v<T, double>, "Vector::fill_rademacher is only supported for double");
+
+        double* py = this->data();
+        size_t n = size_;
+
+        // One Philox block -> 4 elements, sign from the top bit of each word
+        detail::parallel_chunks((n + 3) / 4, [&](size_t off, size_t cnt) {
+            size_t full = std::min(off + cnt, n / 4);
+
+            #pragma omp simd
+            for (size_t blk = off; blk < full; blk++) {
+                detail::philox_block r = detail::philox4x32(blk, stream, seed);
+                py[4 * blk]     = (r.v[0] >> 31) ? -1.0 : 1.0;
+                py[4 * blk + 1] = (r.v[1] >> 31) ? -1.0 : 1.0;
+                py[4 * blk + 2] = (r.v[2] >> 31) ? -1.0 : 1.0;
+                py[4 * blk + 3] = (r.v[3] >> 31) ? -1.0 : 1.0;
+            }
+
+            if (full < off + cnt) {
+                detail::philox_block r = detail::philox4x32(full, stream, seed);
+                for (size_t i = 4 * full; i < n; i++) py[i] = (r.v[i - 4 * full] >> 31) ? -1.0 : 1.0;
+            }
+        });
+    }
 }; // class
 
 } // namespace
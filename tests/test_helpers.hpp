@@ -0,0 +1,47 @@
+#ifndef BLAS_WRAPPER_TESTS_TEST_HELPERS_HPP
+#define BLAS_WRAPPER_TESTS_TEST_HELPERS_HPP
+
+#include <gtest/gtest.h>
+#include <blas_wrapper/vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+// Shared test data and checks for tests/*/*.cpp
+namespace test_helpers {
+
+using cd = std::complex<double>;
+
+// Small size and one above the threshold, so both the single call and
+// the chunked OpenMP path are exercised
+inline const std::vector<size_t> kSizes = { 1, 17, blas_wrapper::detail::parallel_threshold + 3 };
+
+inline constexpr double kTol = 1e-13;
+
+// Real parts in [0.5, 3.5): valid input for log, sqrt and division
+inline double value_at(size_t i, double) {
+    return 0.5 + std::fmod(0.37 * static_cast<double>(i), 3.0);
+}
+
+inline cd value_at(size_t i, cd) {
+    return cd(value_at(i, 0.0), std::fmod(0.11 * static_cast<double>(i), 2.0) - 1.0);
+}
+
+template <typename T>
+blas_wrapper::Vector<T> make_vector(size_t n, size_t shift = 0) {
+    blas_wrapper::Vector<T> v(n);
+    for (size_t i = 0; i < n; i++) v[i] = value_at(i + shift, T());
+    return v;
+}
+
+// Relative error for |ref| >= 1, absolute below
+template <typename T>
+void expect_close(const T& got, const T& ref, double tol = kTol) {
+    EXPECT_LE(std::abs(got - ref), tol * std::max(1.0, std::abs(ref)));
+}
+
+} // namespace test_helpers
+
+#endif // BLAS_WRAPPER_TESTS_TEST_HELPERS_HPP
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <blas_wrapper/compressed_vector.hpp>
+#include "test_helpers.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using blas_wrapper::Vector;
+using blas_wrapper::CompressedVector;
+using blas_wrapper::bfloat16;
+using blas_wrapper::Rounding;
+using blas_wrapper::detail::encode_bf16;
+using blas_wrapper::detail::decode_bf16;
+using blas_wrapper::detail::encode_float;
+using blas_wrapper::detail::float_bits_toward_zero;
+using blas_wrapper::detail::bits_float;
+using test_helpers::cd;
+using test_helpers::kSizes;
+
+namespace {
+
+double bf16_ne(double d) {
+    return decode_bf16(encode_bf16(d, Rounding::NearestEven));
+}
+
+double bf16_tz(double d) {
+    return decode_bf16(encode_bf16(d, Rounding::TowardZero));
+}
+
+// Multiples of 1/4 in [-3, 3]: exact in bf16, and so are their sums below
+double exact_at(size_t i) {
+    return 0.25 * static_cast<double>(static_cast<int>(i % 25) - 12);
+}
+
+} // namespace
+
+// ---------- ОКРУГЛЕНИЕ ----------
+
+TEST(CompressedVectorRounding, Bf16NearestEvenTies) {
+    // bf16 ulp at 1 is 2^-7, so 1 + 2^-8 is halfway between 1 and 1 + 2^-7
+    EXPECT_EQ(bf16_ne(1.00390625), 1.0);        // tie, 1 is even
+    EXPECT_EQ(bf16_ne(1.01171875), 1.015625);   // tie, rounds up to even
+    EXPECT_EQ(bf16_ne(-1.00390625), -1.0);
+    EXPECT_EQ(bf16_ne(1.005859375), 1.0078125);
+}
+
+TEST(CompressedVectorRounding, Bf16JustAboveAndBelowTie) {
+    // Differences below fp32 precision must not be lost by rounding twice
+    EXPECT_EQ(bf16_ne(1.00390625 + 0x1.0p-40), 1.0078125);
+    EXPECT_EQ(bf16_ne(1.00390625 - 0x1.0p-40), 1.0);
+    EXPECT_EQ(bf16_ne(-(1.00390625 + 0x1.0p-40)), -1.0078125);
+}
+
+TEST(CompressedVectorRounding, TowardZero) {
+    EXPECT_EQ(bf16_tz(1.0078125 - 0x1.0p-40), 1.0);
+    EXPECT_EQ(bf16_tz(-1.0078125 + 0x1.0p-40), -1.0);
+    EXPECT_EQ(bf16_tz(1.0078125), 1.0078125);
+
+    for (double d : { 1.0 / 3.0, -1.0 / 3.0, 1e-3, -7.77e20 }) {
+        float f = bits_float(float_bits_toward_zero(d));
+        EXPECT_LE(std::fabs(static_cast<double>(f)), std::fabs(d));
+        EXPECT_GT(std::fabs(static_cast<double>(std::nextafter(f, 2.0f * f))), std::fabs(d));
+        EXPECT_EQ(encode_float(d, Rounding::TowardZero), f);
+    }
+
+    // Exactly representable values are unchanged
+    EXPECT_EQ(bits_float(float_bits_toward_zero(0.5)), 0.5f);
+    EXPECT_EQ(bits_float(float_bits_toward_zero(-0.0)), -0.0f);
+}
+
+TEST(CompressedVectorRounding, Overflow) {
+    const double bf16_max = decode_bf16(bfloat16{ 0x7F7F });
+    const double inf = std::numeric_limits<double>::infinity();
+
+    EXPECT_EQ(bf16_ne(1e39), inf);
+    EXPECT_EQ(bf16_ne(-1e39), -inf);
+    EXPECT_EQ(bf16_tz(1e39), bf16_max);
+    EXPECT_EQ(bf16_tz(-1e39), -bf16_max);
+    EXPECT_EQ(bf16_ne(bf16_max), bf16_max);
+    EXPECT_EQ(bf16_tz(inf), inf);
+
+    EXPECT_EQ(encode_float(1e39, Rounding::NearestEven), std::numeric_limits<float>::infinity());
+    EXPECT_EQ(encode_float(-1e39, Rounding::NearestEven), -std::numeric_limits<float>::infinity());
+    EXPECT_EQ(encode_float(1e39, Rounding::TowardZero), std::numeric_limits<float>::max());
+    EXPECT_EQ(encode_float(-1e39, Rounding::TowardZero), -std::numeric_limits<float>::max());
+}
+
+TEST(CompressedVectorRounding, NaNStaysQuiet) {
+    for (double nan : { std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::signaling_NaN() }) {
+        for (Rounding mode : { Rounding::NearestEven, Rounding::TowardZero }) {
+            bfloat16 h = encode_bf16(nan, mode);
+            EXPECT_EQ(h.bits & 0x7F80u, 0x7F80u);
+            EXPECT_NE(h.bits & 0x0040u, 0u);
+            EXPECT_TRUE(std::isnan(decode_bf16(h)));
+            EXPECT_TRUE(std::isnan(encode_float(nan, mode)));
+        }
+    }
+}
+
+TEST(CompressedVectorRounding, Subnormals) {
+    // Smallest bf16 subnormal is 2^-133 (bits 0x0001)
+    const double tiny = 0x1.0p-133;
+
+    EXPECT_EQ(encode_bf16(tiny, Rounding::NearestEven).bits, 0x0001u);
+    EXPECT_EQ(encode_bf16(3 * tiny, Rounding::NearestEven).bits, 0x0003u);
+    EXPECT_EQ(encode_bf16(1.5 * tiny, Rounding::NearestEven).bits, 0x0002u);   // tie to even
+    EXPECT_EQ(encode_bf16(0.5 * tiny, Rounding::NearestEven).bits, 0x0000u);   // tie to even (zero)
+    EXPECT_EQ(encode_bf16(0.5 * tiny * (1 + 1e-6), Rounding::NearestEven).bits, 0x0001u);
+    EXPECT_EQ(encode_bf16(1.9 * tiny, Rounding::TowardZero).bits, 0x0001u);
+    EXPECT_EQ(encode_bf16(-1.9 * tiny, Rounding::TowardZero).bits, 0x8001u);
+
+    // fp32 subnormal
+    const double ftiny = static_cast<double>(std::numeric_limits<float>::denorm_min());
+    EXPECT_EQ(static_cast<double>(encode_float(3 * ftiny, Rounding::NearestEven)), 3 * ftiny);
+    EXPECT_EQ(static_cast<double>(encode_float(2.9 * ftiny, Rounding::NearestEven)), 3 * ftiny);
+    EXPECT_EQ(static_cast<double>(encode_float(2.9 * ftiny, Rounding::TowardZero)), 2 * ftiny);
+    EXPECT_EQ(static_cast<double>(encode_float(0.9 * ftiny, Rounding::TowardZero)), 0.0);
+}
+
+// ---------- ОПЕРАЦИИ ----------
+
+template <typename S>
+void check_real_operations() {
+    for (size_t n : kSizes) {
+        Vector<double> x(n), y(n);
+        for (size_t i = 0; i < n; i++) {
+            x[i] = exact_at(i);
+            y[i] = exact_at(i + 7);
+        }
+
+        CompressedVector<S> cx(x), cy(y);
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(cx.get(i), x[i]);
+
+        EXPECT_EQ(cy.dot(cx), y.dot(x));
+        EXPECT_DOUBLE_EQ(cy.nrm2(), y.nrm2());
+        EXPECT_EQ(cy.asum(), y.asum());
+
+        cy.axpy(0.5, cx);
+        y.axpy(0.5, x);
+        Vector<double> dy = cy.to_vector();
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(dy[i], y[i]);
+    }
+}
+
+TEST(CompressedVectorOperations, Float) {
+    check_real_operations<float>();
+}
+
+TEST(CompressedVectorOperations, Bfloat16) {
+    check_real_operations<bfloat16>();
+}
+
+TEST(CompressedVectorOperations, ComplexFloat) {
+    for (size_t n : kSizes) {
+        Vector<cd> x(n), y(n);
+        for (size_t i = 0; i < n; i++) {
+            x[i] = cd(exact_at(i), exact_at(i + 3));
+            y[i] = cd(exact_at(i + 7), exact_at(i + 11));
+        }
+
+        CompressedVector<std::complex<float>> cx(x), cy(y);
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(cx.get(i), x[i]);
+
+        EXPECT_EQ(cy.dotu(cx), y.dotu(x));
+        EXPECT_EQ(cy.dotc(cx), y.dotc(x));
+        EXPECT_DOUBLE_EQ(cy.nrm2(), y.nrm2());
+        EXPECT_EQ(cy.asum(), y.asum());
+
+        cy.axpy(cd(0.5, -0.25), cx);
+        y.axpy(cd(0.5, -0.25), x);
+        Vector<cd> dy = cy.to_vector();
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(dy[i], y[i]);
+    }
+}
+
+TEST(CompressedVectorOperations, AxpyRounding) {
+    // 0 + 1.01171875 * 1 is a bf16 tie between 1.0078125 and 1.015625
+    Vector<double> x(1), y(1);
+    x[0] = 1.0;
+    y[0] = 0.0;
+
+    CompressedVector<bfloat16> ne(y), tz(y), cx(x);
+    ne.axpy(1.01171875, cx, Rounding::NearestEven);
+    tz.axpy(1.01171875, cx, Rounding::TowardZero);
+
+    EXPECT_EQ(ne.get(0), 1.015625);
+    EXPECT_EQ(tz.get(0), 1.0078125);
+}
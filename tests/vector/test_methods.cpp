@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <blas_wrapper/vector.hpp>
+#include "test_helpers.hpp"
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using blas_wrapper::Vector;
+using blas_wrapper::VmMode;
+using test_helpers::cd;
+using test_helpers::kSizes;
+using test_helpers::value_at;
+using test_helpers::make_vector;
+using test_helpers::expect_close;
+
+namespace {
+
+// Checks in-place (y.f()), out-of-place (y.f(x)) and aliased (y.f(y))
+// forms of a unary operation against a scalar reference
+template <typename T, typename Op, typename Ref>
+void check_unary(Op op, Ref ref) {
+    for (size_t n : kSizes) {
+        Vector<T> x = make_vector<T>(n);
+
+        Vector<T> out(n);
+        op(out, &x);
+        for (size_t i = 0; i < n; i++) expect_close(out[i], ref(x[i]));
+
+        Vector<T> in_place = make_vector<T>(n);
+        op(in_place, static_cast<Vector<T>*>(nullptr));
+        for (size_t i = 0; i < n; i++) expect_close(in_place[i], ref(x[i]));
+
+        Vector<T> aliased = make_vector<T>(n);
+        op(aliased, &aliased);
+        for (size_t i = 0; i < n; i++) expect_close(aliased[i], ref(x[i]));
+    }
+}
+
+// Same for a binary operation: y.f(x) is y := f(y, x), y.f(a, b) is y := f(a, b)
+template <typename T, typename Op, typename Ref>
+void check_binary(Op op, Ref ref) {
+    for (size_t n : kSizes) {
+        Vector<T> a = make_vector<T>(n);
+        Vector<T> b = make_vector<T>(n, 5);
+
+        Vector<T> out(n);
+        op(out, a, &b);
+        for (size_t i = 0; i < n; i++) expect_close(out[i], ref(a[i], b[i]));
+
+        Vector<T> in_place = make_vector<T>(n);
+        op(in_place, b, static_cast<Vector<T>*>(nullptr));
+        for (size_t i = 0; i < n; i++) expect_close(in_place[i], ref(a[i], b[i]));
+
+        Vector<T> aliased = make_vector<T>(n);
+        op(aliased, aliased, &b);
+        for (size_t i = 0; i < n; i++) expect_close(aliased[i], ref(a[i], b[i]));
+    }
+}
+
+} // namespace
+
+#define UNARY_OP(name) \
+    [](auto& y, auto* x) { if (x) y.name(*x); else y.name(); }
+
+#define BINARY_OP(name) \
+    [](auto& y, auto& a, auto* b) { if (b) y.name(a, *b); else y.name(a); }
+
+TEST(VectorElementwise, MulDouble) {
+    check_binary<double>(BINARY_OP(mul), [](double a, double b) { return a * b; });
+}
+
+TEST(VectorElementwise, MulComplex) {
+    check_binary<cd>(BINARY_OP(mul), [](cd a, cd b) { return a * b; });
+}
+
+TEST(VectorElementwise, DivDouble) {
+    check_binary<double>(BINARY_OP(div), [](double a, double b) { return a / b; });
+}
+
+TEST(VectorElementwise, DivComplex) {
+    check_binary<cd>(BINARY_OP(div), [](cd a, cd b) { return a / b; });
+}
+
+TEST(VectorElementwise, InvDouble) {
+    check_unary<double>(UNARY_OP(inv), [](double a) { return 1.0 / a; });
+}
+
+TEST(VectorElementwise, InvComplex) {
+    check_unary<cd>(UNARY_OP(inv), [](cd a) { return 1.0 / a; });
+}
+
+TEST(VectorElementwise, ExpDouble) {
+    check_unary<double>(UNARY_OP(exp), [](double a) { return std::exp(a); });
+}
+
+TEST(VectorElementwise, ExpComplex) {
+    check_unary<cd>(UNARY_OP(exp), [](cd a) { return std::exp(a); });
+}
+
+TEST(VectorElementwise, LogDouble) {
+    check_unary<double>(UNARY_OP(log), [](double a) { return std::log(a); });
+}
+
+TEST(VectorElementwise, LogComplex) {
+    check_unary<cd>(UNARY_OP(log), [](cd a) { return std::log(a); });
+}
+
+TEST(VectorElementwise, SqrtDouble) {
+    check_unary<double>(UNARY_OP(sqrt), [](double a) { return std::sqrt(a); });
+}
+
+TEST(VectorElementwise, SqrtComplex) {
+    check_unary<cd>(UNARY_OP(sqrt), [](cd a) { return std::sqrt(a); });
+}
+
+TEST(VectorElementwise, DivInvComplexExtremeMagnitudes) {
+    // |b|^2 overflows (1e200) or underflows (1e-200) without scaling
+    const double scales[] = { 1e200, 1e-200, 1e300, 1e-300 };
+    Vector<cd> a(4), b(4);
+    for (size_t i = 0; i < 4; i++) {
+        a[i] = cd(1.5, -0.5) * scales[i];
+        b[i] = cd(-0.25, 2.0) * scales[i];
+    }
+
+    Vector<cd> q(4);
+    q.div(a, b);
+    for (size_t i = 0; i < 4; i++) expect_close(q[i], cd(1.5, -0.5) / cd(-0.25, 2.0));
+
+    Vector<cd> r(4);
+    r.inv(b);
+    for (size_t i = 0; i < 4; i++) expect_close(r[i] * scales[i], 1.0 / cd(-0.25, 2.0));
+}
+
+TEST(VectorElementwise, AbsDouble) {
+    for (size_t n : kSizes) {
+        Vector<double> x(n);
+        for (size_t i = 0; i < n; i++) x[i] = (i % 2 ? -1.0 : 1.0) * value_at(i, 0.0);
+
+        Vector<double> out(n);
+        out.abs(x);
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(out[i], std::fabs(x[i]));
+
+        Vector<double> in_place(x);
+        in_place.abs();
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(in_place[i], std::fabs(x[i]));
+
+        Vector<double> aliased(x);
+        aliased.abs(aliased);
+        for (size_t i = 0; i < n; i++) EXPECT_EQ(aliased[i], std::fabs(x[i]));
+    }
+}
+
+TEST(VectorElementwise, AbsArgComplex) {
+    for (size_t n : kSizes) {
+        Vector<cd> z = make_vector<cd>(n);
+
+        Vector<double> modulus(n);
+        modulus.abs(z);
+        Vector<double> argument(n);
+        argument.arg(z);
+
+        for (size_t i = 0; i < n; i++) {
+            expect_close(modulus[i], std::abs(z[i]));
+            expect_close(argument[i], std::arg(z[i]));
+        }
+    }
+}
+
+TEST(VectorElementwise, AccuracyModes) {
+    Vector<double> x = make_vector<double>(64);
+
+    for (VmMode mode : { VmMode::High, VmMode::Low, VmMode::EnhancedPerformance }) {
+        Vector<double> y(64);
+        y.exp(x, mode);
+
+        // EP mode only guarantees about half of the mantissa bits
+        for (size_t i = 0; i < 64; i++) EXPECT_NEAR(y[i], std::exp(x[i]), 1e-6 * std::exp(x[i]));
+    }
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <blas_wrapper/multivector.hpp>
+#include "test_helpers.hpp"
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using blas_wrapper::Vector;
+using blas_wrapper::MultiVector;
+using test_helpers::cd;
+using test_helpers::value_at;
+using test_helpers::make_vector;
+using test_helpers::expect_close;
+
+namespace {
+
+// Distinct columns: column j starts at value index 31 * j
+template <typename T>
+MultiVector<T> make_multivector(size_t rows, size_t cols) {
+    MultiVector<T> v(rows, cols);
+    for (size_t j = 0; j < cols; j++) {
+        for (size_t i = 0; i < rows; i++) v(i, j) = value_at(i + 31 * j, T());
+    }
+    return v;
+}
+
+// Per-column reference with this repo's convention: y.dotc(x) = x^H y
+double column_dot(Vector<double> col, Vector<double>& x) {
+    return col.dot(x);
+}
+
+cd column_dot(Vector<cd> col, Vector<cd>& x) {
+    return x.dotc(col);
+}
+
+template <typename T>
+void check_block_operations(size_t rows, size_t cols) {
+    MultiVector<T> v = make_multivector<T>(rows, cols);
+    Vector<T> x = make_vector<T>(rows, 17);
+
+    // dots: r_j = v_j^H x
+    Vector<T> r = v.dots(x);
+    ASSERT_EQ(r.size(), cols);
+    for (size_t j = 0; j < cols; j++) expect_close(r[j], column_dot(v.col(j), x));
+
+    // update: y := alpha * V * c + y, reference is k axpy calls
+    T alpha = T(-0.5);
+    Vector<T> y = make_vector<T>(rows, 17);
+    Vector<T> y_ref = make_vector<T>(rows, 17);
+    v.update(r, y, alpha);
+    for (size_t j = 0; j < cols; j++) {
+        Vector<T> col = v.col(j);
+        y_ref.axpy(alpha * r[j], col);
+    }
+    for (size_t i = 0; i < rows; i++) expect_close(y[i], y_ref[i]);
+
+    // gram: G_ij = v_i^H v_j
+    MultiVector<T> g = v.gram();
+    ASSERT_EQ(g.rows(), cols);
+    ASSERT_EQ(g.cols(), cols);
+    for (size_t j = 0; j < cols; j++) {
+        Vector<T> vj = v.col(j);
+        for (size_t i = 0; i < cols; i++) expect_close(g(i, j), column_dot(v.col(i), vj));
+    }
+
+    // nrm2: per column
+    Vector<double> norms = v.nrm2();
+    ASSERT_EQ(norms.size(), cols);
+    for (size_t j = 0; j < cols; j++) expect_close(norms[j], v.col(j).nrm2());
+}
+
+} // namespace
+
+TEST(MultiVector, BlockOperationsDouble) {
+    check_block_operations<double>(37, 5);
+    check_block_operations<double>(1, 1);
+}
+
+TEST(MultiVector, BlockOperationsComplex) {
+    check_block_operations<cd>(37, 5);
+    check_block_operations<cd>(1, 1);
+}
+
+TEST(MultiVector, ZeroRows) {
+    MultiVector<double> v(0, 3);
+    Vector<double> x(0);
+
+    Vector<double> r = v.dots(x);
+    for (size_t j = 0; j < 3; j++) EXPECT_EQ(r[j], 0.0);
+
+    MultiVector<double> g = v.gram();
+    for (size_t j = 0; j < 3; j++) {
+        for (size_t i = 0; i < 3; i++) EXPECT_EQ(g(i, j), 0.0);
+    }
+
+    Vector<double> norms = v.nrm2();
+    for (size_t j = 0; j < 3; j++) EXPECT_EQ(norms[j], 0.0);
+
+    Vector<double> coeffs(3);
+    for (size_t j = 0; j < 3; j++) coeffs[j] = 1.0;
+    v.update(coeffs, x);
+    EXPECT_EQ(x.size(), 0u);
+}
+
+TEST(MultiVector, ZeroCols) {
+    MultiVector<cd> v(4, 0);
+    Vector<cd> x = make_vector<cd>(4, 17);
+
+    EXPECT_EQ(v.dots(x).size(), 0u);
+    EXPECT_EQ(v.gram().rows(), 0u);
+    EXPECT_EQ(v.nrm2().size(), 0u);
+
+    Vector<cd> coeffs(0);
+    v.update(coeffs, x);
+    for (size_t i = 0; i < 4; i++) EXPECT_EQ(x[i], value_at(i + 17, cd()));
+}
+
+TEST(MultiVector, ColumnViewWritesThrough) {
+    MultiVector<double> v = make_multivector<double>(3, 2);
+
+    Vector<double> c = v.col(1);
+    EXPECT_TRUE(c.is_view());
+    EXPECT_EQ(c.data(), v.data() + 3);
+
+    c[2] = 42.0;
+    EXPECT_EQ(v(2, 1), 42.0);
+
+    c.scal(2.0);
+    EXPECT_EQ(v(2, 1), 84.0);
+    EXPECT_EQ(v(0, 1), 2.0 * value_at(31, 0.0));
+}
+
+TEST(MultiVector, AssignToViewWritesThrough) {
+    MultiVector<double> v(3, 2);
+    for (size_t j = 0; j < 2; j++) {
+        for (size_t i = 0; i < 3; i++) v(i, j) = 0.0;
+    }
+
+    Vector<double> ones(3);
+    for (size_t i = 0; i < 3; i++) ones[i] = 1.0;
+
+    v.col(0) = ones;
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_EQ(v(i, 0), 1.0);
+        EXPECT_EQ(v(i, 1), 0.0);
+    }
+
+    // Named view stays a view after assignment
+    Vector<double> c = v.col(1);
+    c = ones;
+    EXPECT_TRUE(c.is_view());
+    EXPECT_EQ(c.data(), v.data() + 3);
+    for (size_t i = 0; i < 3; i++) EXPECT_EQ(v(i, 1), 1.0);
+
+    // Assigning view to view copies elements between columns
+    v(1, 0) = 7.0;
+    c = v.col(0);
+    EXPECT_EQ(v(1, 1), 7.0);
+}
+
+TEST(MultiVector, CopyOfViewIsView) {
+    MultiVector<double> v = make_multivector<double>(3, 2);
+
+    // Named view passed by value and stored in a container
+    Vector<double> c = v.col(1);
+    auto scale_column = [](Vector<double> col) { col.scal(2.0); };
+    scale_column(c);
+    EXPECT_EQ(v(0, 1), 2.0 * value_at(31, 0.0));
+
+    std::vector<Vector<double>> cols = { v.col(0), v.col(1) };
+    for (auto& col : cols) EXPECT_TRUE(col.is_view());
+    EXPECT_EQ(cols[1].data(), v.data() + 3);
+
+    Vector<double> copy(c);
+    EXPECT_TRUE(copy.is_view());
+    copy[2] = 42.0;
+    EXPECT_EQ(v(2, 1), 42.0);
+}
+
+TEST(MultiVector, CloneOfViewOwnsData) {
+    MultiVector<cd> v = make_multivector<cd>(4, 2);
+
+    Vector<cd> view = v.col(0);
+    Vector<cd> copy = view.clone();
+    EXPECT_FALSE(copy.is_view());
+    EXPECT_NE(copy.data(), view.data());
+
+    copy[0] = cd(100.0, 0.0);
+    EXPECT_EQ(v(0, 0), value_at(0, cd()));
+
+    // Assigning a view into an owning vector copies it, no aliasing
+    Vector<cd> owner(4);
+    owner = view;
+    EXPECT_FALSE(owner.is_view());
+    EXPECT_NE(owner.data(), view.data());
+    EXPECT_EQ(owner[3], v(3, 0));
+}
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include <blas_wrapper/vector.hpp>
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+using blas_wrapper::Vector;
+using blas_wrapper::detail::philox4x32;
+using cd = std::complex<double>;
+
+namespace {
+
+constexpr std::uint64_t kSeed = 0x0123456789ABCDEFull;
+constexpr std::uint64_t kStream = 3;
+
+// Sizes around the SIMD block (2 or 4 elements) and the parallel threshold
+const std::vector<size_t> kTailSizes = {
+    1, 2, 3, 4, 5, 6, 7, 9, 13,
+    blas_wrapper::detail::parallel_threshold - 1,
+    blas_wrapper::detail::parallel_threshold + 1,
+    blas_wrapper::detail::parallel_threshold + 2,
+    blas_wrapper::detail::parallel_threshold + 3
+};
+
+const size_t kLarge = 4 * blas_wrapper::detail::parallel_threshold + 7;
+
+template <typename T>
+bool bit_equal(const Vector<T>& a, const Vector<T>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+// Fills a view into a buffer with sentinels after the end: the fill must
+// reproduce a prefix of a longer fill and must not write past n
+template <typename T, typename Fill>
+void check_tails(Fill fill) {
+    const size_t max_n = kTailSizes.back();
+    Vector<T> reference(max_n);
+    fill(reference);
+
+    const T sentinel = T(12345.0);
+    for (size_t n : kTailSizes) {
+        std::vector<T> buffer(n + 4, sentinel);
+        Vector<T> v(buffer.data(), n);
+        fill(v);
+
+        EXPECT_EQ(std::memcmp(v.data(), reference.data(), n * sizeof(T)), 0) << "n = " << n;
+        for (size_t i = n; i < n + 4; i++) EXPECT_EQ(buffer[i], sentinel) << "n = " << n;
+    }
+}
+
+template <typename T, typename Fill>
+void check_thread_independence(Fill fill) {
+    Vector<T> serial(kLarge);
+
+#ifdef _OPENMP
+    int saved = omp_get_max_threads();
+    omp_set_num_threads(1);
+    fill(serial);
+
+    for (int threads : { 2, 3, 4, 7 }) {
+        omp_set_num_threads(threads);
+        Vector<T> parallel(kLarge);
+        fill(parallel);
+        EXPECT_TRUE(bit_equal(serial, parallel)) << threads << " threads";
+    }
+
+    omp_set_num_threads(saved);
+#else
+    fill(serial);
+    Vector<T> again(kLarge);
+    fill(again);
+    EXPECT_TRUE(bit_equal(serial, again));
+#endif
+}
+
+struct Moments {
+    double mean;
+    double variance;
+};
+
+Moments moments(const double* x, size_t n, size_t stride = 1) {
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++) sum += x[i * stride];
+    double mean = sum / static_cast<double>(n);
+
+    double sq = 0.0;
+    for (size_t i = 0; i < n; i++) sq += (x[i * stride] - mean) * (x[i * stride] - mean);
+
+    return Moments{ mean, sq / static_cast<double>(n) };
+}
+
+auto uniform_fill = [](auto& v) { v.fill_uniform(kSeed, -1.0, 3.0, kStream); };
+auto normal_fill = [](auto& v) { v.fill_normal(kSeed, 2.0, 0.5, kStream); };
+auto complex_normal_fill = [](auto& v) { v.fill_normal(kSeed, cd(1.0, -1.0), 2.0, kStream); };
+auto rademacher_fill = [](auto& v) { v.fill_rademacher(kSeed, kStream); };
+
+} // namespace
+
+// ---------- PHILOX ----------
+
+// Known-answer vectors of Philox4x32-10 from Random123 (kat_vectors):
+// counter = (c0, c1, c2, c3), key = (k0, k1) map to
+// block = c1:c0, stream = c3:c2, seed = k1:k0
+TEST(Philox, KnownAnswerZero) {
+    auto r = philox4x32(0, 0, 0);
+    EXPECT_EQ(r.v[0], 0x6627e8d5u);
+    EXPECT_EQ(r.v[1], 0xe169c58du);
+    EXPECT_EQ(r.v[2], 0xbc57ac4cu);
+    EXPECT_EQ(r.v[3], 0x9b00dbd8u);
+}
+
+TEST(Philox, KnownAnswerOnes) {
+    auto r = philox4x32(~0ull, ~0ull, ~0ull);
+    EXPECT_EQ(r.v[0], 0x408f276du);
+    EXPECT_EQ(r.v[1], 0x41c83b0eu);
+    EXPECT_EQ(r.v[2], 0xa20bc7c6u);
+    EXPECT_EQ(r.v[3], 0x6d5451fdu);
+}
+
+TEST(Philox, KnownAnswerPi) {
+    auto r = philox4x32(0x85a308d3243f6a88ull, 0x0370734413198a2eull, 0x299f31d0a4093822ull);
+    EXPECT_EQ(r.v[0], 0xd16cfe09u);
+    EXPECT_EQ(r.v[1], 0x94fdccebu);
+    EXPECT_EQ(r.v[2], 0x5001e420u);
+    EXPECT_EQ(r.v[3], 0x24126ea1u);
+}
+
+// ---------- ВОСПРОИЗВОДИМОСТЬ ----------
+
+TEST(VectorRandomFill, ThreadCountIndependent) {
+    check_thread_independence<double>(uniform_fill);
+    check_thread_independence<double>(normal_fill);
+    check_thread_independence<double>(rademacher_fill);
+    check_thread_independence<cd>(uniform_fill);
+    check_thread_independence<cd>(complex_normal_fill);
+}
+
+TEST(VectorRandomFill, ElementDependsOnlyOnIndex) {
+    Vector<double> v(kLarge);
+    v.fill_uniform(kSeed, 0.0, 1.0, kStream);
+
+    // Element i comes from block i / 2, words (0, 1) or (2, 3)
+    for (size_t i : { size_t(0), size_t(1), size_t(2), kLarge / 2, kLarge - 1 }) {
+        auto r = philox4x32(i / 2, kStream, kSeed);
+        std::uint64_t u = (i % 2 == 0)
+            ? (static_cast<std::uint64_t>(r.v[1]) << 32 | r.v[0])
+            : (static_cast<std::uint64_t>(r.v[3]) << 32 | r.v[2]);
+        EXPECT_EQ(v[i], static_cast<double>(u >> 11) * 0x1.0p-53);
+    }
+}
+
+TEST(VectorRandomFill, SeedAndStreamChangeSequence) {
+    Vector<double> a(64), b(64), c(64);
+    a.fill_uniform(1);
+    b.fill_uniform(2);
+    c.fill_uniform(1, 0.0, 1.0, 1);
+
+    EXPECT_FALSE(bit_equal(a, b));
+    EXPECT_FALSE(bit_equal(a, c));
+}
+
+TEST(VectorRandomFill, Tails) {
+    check_tails<double>(uniform_fill);
+    check_tails<double>(normal_fill);
+    check_tails<double>(rademacher_fill);
+    check_tails<cd>(uniform_fill);
+    check_tails<cd>(complex_normal_fill);
+}
+
+// ---------- РАСПРЕДЕЛЕНИЯ ----------
+
+TEST(VectorRandomFill, UniformMoments) {
+    const size_t n = size_t(1) << 20;
+    Vector<double> v(n);
+    v.fill_uniform(kSeed, -1.0, 3.0);
+
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_GE(v[i], -1.0);
+        ASSERT_LT(v[i], 3.0);
+    }
+
+    Moments m = moments(v.data(), n);
+    EXPECT_NEAR(m.mean, 1.0, 0.01);
+    EXPECT_NEAR(m.variance, 16.0 / 12.0, 0.01);
+}
+
+TEST(VectorRandomFill, NormalMoments) {
+    const size_t n = size_t(1) << 20;
+    Vector<double> v(n);
+    v.fill_normal(kSeed, 2.0, 0.5);
+
+    Moments m = moments(v.data(), n);
+    EXPECT_NEAR(m.mean, 2.0, 0.005);
+    EXPECT_NEAR(m.variance, 0.25, 0.005);
+}
+
+TEST(VectorRandomFill, ComplexNormalMoments) {
+    const size_t n = size_t(1) << 20;
+    Vector<cd> v(n);
+    v.fill_normal(kSeed, cd(1.0, -1.0), 2.0);
+
+    // CN(mean, 4): Re and Im each carry half of the variance
+    const double* p = reinterpret_cast<const double*>(v.data());
+    Moments re = moments(p, n, 2);
+    Moments im = moments(p + 1, n, 2);
+
+    EXPECT_NEAR(re.mean, 1.0, 0.01);
+    EXPECT_NEAR(im.mean, -1.0, 0.01);
+    EXPECT_NEAR(re.variance, 2.0, 0.02);
+    EXPECT_NEAR(im.variance, 2.0, 0.02);
+
+    double cross = 0.0;
+    for (size_t i = 0; i < n; i++) cross += (v[i].real() - re.mean) * (v[i].imag() - im.mean);
+    EXPECT_NEAR(cross / static_cast<double>(n), 0.0, 0.02);
+}
+
+TEST(VectorRandomFill, ComplexUniformMoments) {
+    const size_t n = size_t(1) << 20;
+    Vector<cd> v(n);
+    v.fill_uniform(kSeed, 0.0, 1.0);
+
+    const double* p = reinterpret_cast<const double*>(v.data());
+    Moments re = moments(p, n, 2);
+    Moments im = moments(p + 1, n, 2);
+
+    EXPECT_NEAR(re.mean, 0.5, 0.005);
+    EXPECT_NEAR(im.mean, 0.5, 0.005);
+    EXPECT_NEAR(re.variance, 1.0 / 12.0, 0.005);
+    EXPECT_NEAR(im.variance, 1.0 / 12.0, 0.005);
+}
+
+TEST(VectorRandomFill, RademacherMoments) {
+    const size_t n = size_t(1) << 20;
+    Vector<double> v(n);
+    v.fill_rademacher(kSeed);
+
+    for (size_t i = 0; i < n; i++) ASSERT_TRUE(v[i] == 1.0 || v[i] == -1.0);
+
+    Moments m = moments(v.data(), n);
+    EXPECT_NEAR(m.mean, 0.0, 0.01);
+    EXPECT_NEAR(m.variance, 1.0, 0.01);
+}